@@ -925,12 +925,17 @@ Error LongJmpPass::runOnFunctions(BinaryContext &BC) {
     tentativeLayout(BC, Sorted);
     updateStubGroups();
     for (BinaryFunction *Func : Sorted) {
-      if (auto E = relax(*Func, Modified))
+      // Track changes per function so that only the functions that actually
+      // got new stubs have their branches fixed, rather than every function
+      // after the first modified one.
+      bool FuncModified = false;
+      if (auto E = relax(*Func, FuncModified))
         return Error(std::move(E));
       // Don't ruin non-simple functions, they can't afford to have the layout
       // changed.
-      if (Modified && Func->isSimple())
+      if (FuncModified && Func->isSimple())
         Func->fixBranches();
+      Modified |= FuncModified;
     }
   } while (Modified);
   BC.outs() << "BOLT-INFO: Inserted " << NumHotStubs
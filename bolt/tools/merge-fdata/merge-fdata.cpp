@@ -412,46 +412,73 @@ int main(int argc, char **argv) {
   // Merged information for all functions.
   StringMap<BinaryFunctionProfile> MergedBFs;
 
-  bool FirstHeader = true;
-  for (std::string &InputDataFilename : Inputs) {
-    ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
-        MemoryBuffer::getFileOrSTDIN(InputDataFilename);
-    if (std::error_code EC = MB.getError())
-      report_error(InputDataFilename, EC);
-    yaml::Input YamlInput(MB.get()->getBuffer());
-    YamlInput.setAllowUnknownKeys(true);
-
-    errs() << "Merging data from " << InputDataFilename << "...\n";
-
+  // Parsing the YAML dominates the merge time, so parse a batch of inputs in
+  // parallel and then merge the batch in input order. This keeps the output
+  // deterministic and bounds memory use to one batch of parsed profiles.
+  struct ParsedProfileTy {
+    std::error_code ReadEC;
+    std::error_code ParseEC;
     BinaryProfile BP;
-    YamlInput >> BP;
-    if (YamlInput.error())
-      report_error(InputDataFilename, YamlInput.error());
-
-    // Sanity check.
-    if (BP.Header.Version != 1) {
-      errs() << "Unable to merge data from profile using version "
-             << BP.Header.Version << '\n';
-      exit(1);
-    }
+  };
+  DefaultThreadPool Pool(optimal_concurrency(Inputs.size()));
+  const size_t BatchSize = Pool.getMaxConcurrency();
+  std::vector<ParsedProfileTy> Batch;
 
-    // Merge the header.
-    if (FirstHeader) {
-      MergedHeader = BP.Header;
-      FirstHeader = false;
-    } else {
-      mergeProfileHeaders(MergedHeader, BP.Header);
-    }
+  bool FirstHeader = true;
+  for (size_t Begin = 0; Begin < Inputs.size(); Begin += BatchSize) {
+    ArrayRef<std::string> BatchInputs = ArrayRef(Inputs).slice(
+        Begin, std::min(BatchSize, Inputs.size() - Begin));
+    Batch.clear();
+    Batch.resize(BatchInputs.size());
+    for (size_t I = 0, E = BatchInputs.size(); I != E; ++I)
+      Pool.async([&, I] {
+        ParsedProfileTy &Parsed = Batch[I];
+        ErrorOr<std::unique_ptr<MemoryBuffer>> MB =
+            MemoryBuffer::getFileOrSTDIN(BatchInputs[I]);
+        if ((Parsed.ReadEC = MB.getError()))
+          return;
+        yaml::Input YamlInput(MB.get()->getBuffer());
+        YamlInput.setAllowUnknownKeys(true);
+        YamlInput >> Parsed.BP;
+        Parsed.ParseEC = YamlInput.error();
+      });
+    Pool.wait();
+
+    for (auto [InputDataFilename, Parsed] : zip_equal(BatchInputs, Batch)) {
+      if (Parsed.ReadEC)
+        report_error(InputDataFilename, Parsed.ReadEC);
+
+      errs() << "Merging data from " << InputDataFilename << "...\n";
+
+      if (Parsed.ParseEC)
+        report_error(InputDataFilename, Parsed.ParseEC);
+      BinaryProfile &BP = Parsed.BP;
+
+      // Sanity check.
+      if (BP.Header.Version != 1) {
+        errs() << "Unable to merge data from profile using version "
+               << BP.Header.Version << '\n';
+        exit(1);
+      }
 
-    // Do the function merge.
-    for (BinaryFunctionProfile &BF : BP.Functions) {
-      if (!MergedBFs.count(BF.Name)) {
-        MergedBFs.insert(std::make_pair(BF.Name, BF));
-        continue;
+      // Merge the header.
+      if (FirstHeader) {
+        MergedHeader = BP.Header;
+        FirstHeader = false;
+      } else {
+        mergeProfileHeaders(MergedHeader, BP.Header);
       }
 
-      BinaryFunctionProfile &MergedBF = MergedBFs.find(BF.Name)->second;
-      mergeFunctionProfile(MergedBF, std::move(BF));
+      // Do the function merge.
+      for (BinaryFunctionProfile &BF : BP.Functions) {
+        if (!MergedBFs.count(BF.Name)) {
+          MergedBFs.insert(std::make_pair(BF.Name, BF));
+          continue;
+        }
+
+        BinaryFunctionProfile &MergedBF = MergedBFs.find(BF.Name)->second;
+        mergeFunctionProfile(MergedBF, std::move(BF));
+      }
     }
   }
 
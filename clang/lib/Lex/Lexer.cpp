@@ -50,6 +50,13 @@
 #include <nmmintrin.h>
 #endif
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 using namespace clang;
 
 //===----------------------------------------------------------------------===//
@@ -2611,6 +2618,26 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
 
   char C;
   while (true) {
+#ifdef __SSE2__
+    // Skip 16 bytes at a time while none of them is a newline, a potential EOF
+    // or a non-ASCII character.
+    const __m128i NewLines = _mm_set1_epi8('\n');
+    const __m128i CarriageReturns = _mm_set1_epi8('\r');
+    const __m128i Zeros = _mm_setzero_si128();
+    while (BufferEnd - CurPtr >= 16) {
+      __m128i Cv = _mm_loadu_si128((const __m128i *)CurPtr);
+      __m128i Stop = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(Cv, NewLines),
+                       _mm_cmpeq_epi8(Cv, CarriageReturns)),
+          _mm_cmpeq_epi8(Cv, Zeros));
+      // The sign bit of each byte is set for non-ASCII characters and for the
+      // bytes that compared equal above.
+      if (_mm_movemask_epi8(_mm_or_si128(Stop, Cv)) != 0)
+        break;
+      CurPtr += 16;
+      UnicodeDecodingAlreadyDiagnosed = false;
+    }
+#endif
     C = *CurPtr;
     // Skip over characters in the fast loop.
     while (isASCII(C) && C != 0 &&   // Potentially EOF.
@@ -2849,13 +2876,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
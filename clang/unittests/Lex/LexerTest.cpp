@@ -708,6 +708,24 @@ TEST_F(LexerTest, RawAndNormalLexSameForLineComments) {
   EXPECT_TRUE(ToksView.empty());
 }
 
+TEST_F(LexerTest, LongLineComments) {
+  // Line comments longer than a vector register, with the terminating newline,
+  // an escaped newline, a \r and a non-ASCII character at various offsets.
+  std::vector<Token> Toks =
+      CheckLex("// 0123456789abcdef0123456789abcdef0123456789\n"
+               "a // 0123456789abcdef0123456789abcdef \\\n"
+               "continued 0123456789abcdef0123456789abcdef\n"
+               "b // 0123456789abcdef0123456789\r\n"
+               "c // 0123456789abcdef \xc3\xa9 0123456789abcdef0123456789\n"
+               "d // 0123456789abcdef0123456789abcdef",
+               {tok::identifier, tok::identifier, tok::identifier,
+                tok::identifier});
+  EXPECT_EQ("a", getSourceText(Toks[0], Toks[0]));
+  EXPECT_EQ("b", getSourceText(Toks[1], Toks[1]));
+  EXPECT_EQ("c", getSourceText(Toks[2], Toks[2]));
+  EXPECT_EQ("d", getSourceText(Toks[3], Toks[3]));
+}
+
 TEST_F(LexerTest, GetRawTokenOnEscapedNewLineChecksWhitespace) {
   const llvm::StringLiteral Source = R"cc(
   #define ONE \
@@ -45,6 +45,7 @@
 #include "llvm/Support/CRC.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/ScopedPrinter.h"
 #include "llvm/Support/TimeProfiler.h"
@@ -1688,14 +1689,20 @@ void PDBLinker::addSections(ArrayRef<uint8_t> sectionTable) {
   addCommonLinkerModuleSymbols(nativePath, linkerModule);
 
   // Add section contributions. They must be ordered by ascending RVA.
+  // createSectionContrib computes a CRC of every chunk's contents, so create
+  // the contributions in parallel and add them in order afterwards.
+  std::vector<Chunk *> chunks;
   for (OutputSection *os : ctx.outputSections) {
     addLinkerModuleSectionSymbol(linkerModule, *os, ctx.config.mingw);
-    for (Chunk *c : os->chunks) {
-      pdb::SectionContrib sc =
-          createSectionContrib(ctx, c, linkerModule.getModuleIndex());
-      builder.getDbiBuilder().addSectionContrib(sc);
-    }
+    llvm::append_range(chunks, os->chunks);
   }
+  std::vector<pdb::SectionContrib> contribs(chunks.size());
+  parallelFor(0, chunks.size(), [&](size_t i) {
+    contribs[i] =
+        createSectionContrib(ctx, chunks[i], linkerModule.getModuleIndex());
+  });
+  for (const pdb::SectionContrib &sc : contribs)
+    dbiBuilder.addSectionContrib(sc);
 
   // The * Linker * first section contrib is only used along with /INCREMENTAL,
   // to provide trampolines thunks for incremental function patching. Set this
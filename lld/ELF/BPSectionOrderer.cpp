@@ -56,6 +56,14 @@ struct BPOrdererELF : lld::BPOrderer<BPOrdererELF> {
     hashes.erase(llvm::unique(hashes), hashes.end());
   }
 
+  void getReferencedSections(const Section &sec,
+                             SmallVectorImpl<const Section *> &refs) {
+    for (const Relocation &r : sec.relocs())
+      if (auto *d = dyn_cast_or_null<Defined>(r.sym))
+        if (auto *s = dyn_cast_or_null<InputSectionBase>(d->section))
+          refs.push_back(s);
+  }
+
   static StringRef getSymName(const Defined &sym) { return sym.getName(); }
   static uint64_t getSymValue(const Defined &sym) { return sym.value; }
   static uint64_t getSymSize(const Defined &sym) { return sym.size; }
@@ -65,7 +73,7 @@ struct BPOrdererELF : lld::BPOrderer<BPOrdererELF> {
 DenseMap<const InputSectionBase *, int> elf::runBalancedPartitioning(
     Ctx &ctx, StringRef profilePath, bool forFunctionCompression,
     bool forDataCompression, bool compressionSortStartupFunctions,
-    bool verbose) {
+    bool forStartupData, bool verbose) {
   // Collect candidate sections and associated symbols.
   SmallVector<InputSectionBase *> sections;
   DenseMap<CachedHashStringRef, std::set<unsigned>> rootSymbolToSectionIdxs;
@@ -94,6 +102,7 @@ DenseMap<const InputSectionBase *, int> elf::runBalancedPartitioning(
       addSection(*sym);
   return orderer.computeOrder(profilePath, forFunctionCompression,
                               forDataCompression,
-                              compressionSortStartupFunctions, verbose,
+                              compressionSortStartupFunctions, forStartupData,
+                              verbose,
                               sections, rootSymbolToSectionIdxs);
 }
@@ -27,10 +27,14 @@ class InputSectionBase;
 /// It is important that -ffunction-sections and -fdata-sections compiler flags
 /// are used to ensure functions and data are in their own sections and thus
 /// can be reordered.
+///
+/// If forStartupData is true, data sections referenced by startup functions
+/// are ordered for startup as well.
 llvm::DenseMap<const InputSectionBase *, int>
 runBalancedPartitioning(Ctx &ctx, llvm::StringRef profilePath,
                         bool forFunctionCompression, bool forDataCompression,
-                        bool compressionSortStartupFunctions, bool verbose);
+                        bool compressionSortStartupFunctions,
+                        bool forStartupData, bool verbose);
 
 } // namespace lld::elf
 
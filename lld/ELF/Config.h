@@ -302,6 +302,7 @@ struct Config {
   CGProfileSortKind callGraphProfileSort;
   llvm::StringRef irpgoProfilePath;
   bool bpStartupFunctionSort = false;
+  bool bpStartupDataSort = false;
   bool bpCompressionSortStartupFunctions = false;
   bool bpFunctionOrderForCompression = false;
   bool bpDataOrderForCompression = false;
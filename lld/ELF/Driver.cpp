@@ -1217,12 +1217,15 @@ static void parseBPOrdererOptions(Ctx &ctx, opt::InputArgList &args) {
     StringRef s = arg->getValue();
     if (s == "function") {
       ctx.arg.bpStartupFunctionSort = true;
+    } else if (s == "both") {
+      ctx.arg.bpStartupFunctionSort = true;
+      ctx.arg.bpStartupDataSort = true;
     } else if (s != "none") {
-      ErrAlways(ctx) << arg->getSpelling() << ": expected [none|function]";
+      ErrAlways(ctx) << arg->getSpelling() << ": expected [none|function|both]";
     }
     if (s != "none" && args.hasArg(OPT_call_graph_ordering_file))
-      ErrAlways(ctx) << "--bp-startup-sort=function is incompatible with "
-                        "--call-graph-ordering-file";
+      ErrAlways(ctx) << "--bp-startup-sort=" << s
+                     << " is incompatible with --call-graph-ordering-file";
   }
 
   ctx.arg.bpCompressionSortStartupFunctions =
@@ -1233,8 +1236,9 @@ static void parseBPOrdererOptions(Ctx &ctx, opt::InputArgList &args) {
   ctx.arg.irpgoProfilePath = args.getLastArgValue(OPT_irpgo_profile);
   if (ctx.arg.irpgoProfilePath.empty()) {
     if (ctx.arg.bpStartupFunctionSort)
-      ErrAlways(ctx) << "--bp-startup-sort=function must be used with "
-                        "--irpgo-profile";
+      ErrAlways(ctx) << "--bp-startup-sort="
+                     << (ctx.arg.bpStartupDataSort ? "both" : "function")
+                     << " must be used with --irpgo-profile";
     if (ctx.arg.bpCompressionSortStartupFunctions)
       ErrAlways(ctx)
           << "--bp-compression-sort-startup-functions must be used with "
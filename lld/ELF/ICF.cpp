@@ -460,6 +460,21 @@ static void combineRelocHashes(unsigned cnt, InputSection *isec,
   isec->eqClass[(cnt + 1) % 2] = hash | (1U << 31);
 }
 
+// Hash the parts of a section that equalsConstant compares apart from the
+// relocation targets: content, flags, and relocation offsets and types.
+// Sections that only differ in these end up in different classes from the
+// start, which leaves less work for segregate().
+template <class RelTy>
+static uint64_t hashConstant(Ctx &ctx, const InputSection *isec,
+                             Relocs<RelTy> rels) {
+  SmallVector<uint64_t, 32> buf = {xxh3_64bits(isec->content()), isec->flags};
+  for (const RelTy &rel : rels)
+    buf.push_back(uint64_t(rel.r_offset) << 32 |
+                  rel.getType(ctx.arg.isMips64EL));
+  return xxh3_64bits(ArrayRef(reinterpret_cast<const uint8_t *>(buf.data()),
+                              buf.size() * sizeof(uint64_t)));
+}
+
 // The main function of ICF.
 template <class ELFT> void ICF<ELFT>::run() {
   // Two text sections may have identical content and relocations but different
@@ -490,8 +505,16 @@ template <class ELFT> void ICF<ELFT>::run() {
 
   // Initially, we use hash values to partition sections.
   parallelForEach(sections, [&](InputSection *s) {
+    uint64_t hash;
+    const RelsOrRelas<ELFT> rels = s->template relsOrRelas<ELFT>();
+    if (rels.areRelocsCrel())
+      hash = hashConstant(ctx, s, rels.crels);
+    else if (rels.areRelocsRel())
+      hash = hashConstant(ctx, s, rels.rels);
+    else
+      hash = hashConstant(ctx, s, rels.relas);
     // Set MSB to 1 to avoid collisions with unique IDs.
-    s->eqClass[0] = xxh3_64bits(s->content()) | (1U << 31);
+    s->eqClass[0] = hash | (1U << 31);
   });
 
   // Perform 2 rounds of relocation hash propagation. 2 is an empirical value to
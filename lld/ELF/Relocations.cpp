@@ -1707,21 +1707,45 @@ template <class ELFT> void elf::scanRelocations(Ctx &ctx) {
   bool serial = !ctx.arg.zCombreloc || ctx.arg.emachine == EM_MIPS ||
                 ctx.arg.emachine == EM_PPC64;
   parallel::TaskGroup tg;
+  auto needsScan = [&ctx](const InputSectionBase *s) {
+    return s && s->kind() == SectionBase::Regular && s->isLive() &&
+           (s->flags & SHF_ALLOC) &&
+           !(s->type == SHT_ARM_EXIDX && ctx.arg.emachine == EM_ARM);
+  };
+  auto scanBatch = [&ctx, needsScan](ArrayRef<InputSectionBase *> sections) {
+    RelocationScanner scanner(ctx);
+    for (InputSectionBase *s : sections)
+      if (needsScan(s))
+        scanner.template scanSection<ELFT>(*s);
+  };
+  // A single object file (e.g. an LTO or unity build output) may carry most
+  // relocations of the link. Split such files into batches of about
+  // batchRelocBytes of relocation records so that they don't serialize the
+  // scan. Each section is scanned by exactly one task and the dynamic
+  // relocations are sorted later, so batching does not affect the output.
+  constexpr uint64_t batchRelocBytes = 1 << 20;
   auto outerFn = [&]() {
     for (ELFFileBase *f : ctx.objectFiles) {
-      auto fn = [f, &ctx]() {
-        RelocationScanner scanner(ctx);
-        for (InputSectionBase *s : f->getSections()) {
-          if (s && s->kind() == SectionBase::Regular && s->isLive() &&
-              (s->flags & SHF_ALLOC) &&
-              !(s->type == SHT_ARM_EXIDX && ctx.arg.emachine == EM_ARM))
-            scanner.template scanSection<ELFT>(*s);
+      ArrayRef<InputSectionBase *> sections = f->getSections();
+      if (serial) {
+        scanBatch(sections);
+        continue;
+      }
+      ArrayRef<typename ELFT::Shdr> shdrs = f->template getELFShdrs<ELFT>();
+      size_t begin = 0;
+      uint64_t relocBytes = 0;
+      for (size_t i = 0, e = sections.size(); i != e; ++i) {
+        if (!needsScan(sections[i]) || sections[i]->relSecIdx == 0)
+          continue;
+        relocBytes += shdrs[sections[i]->relSecIdx].sh_size;
+        if (relocBytes >= batchRelocBytes) {
+          tg.spawn([=] { scanBatch(sections.slice(begin, i + 1 - begin)); });
+          begin = i + 1;
+          relocBytes = 0;
         }
-      };
-      if (serial)
-        fn();
-      else
-        tg.spawn(fn);
+      }
+      if (begin != sections.size())
+        tg.spawn([=] { scanBatch(sections.drop_front(begin)); });
     }
     auto scanEH = [&] {
       RelocationScanner scanner(ctx);
@@ -137,6 +137,7 @@ DenseMap<const InputSection *, int> lld::macho::runBalancedPartitioning(
 
   return BPOrdererMachO().computeOrder(profilePath, forFunctionCompression,
                                        forDataCompression,
-                                       compressionSortStartupFunctions, verbose,
+                                       compressionSortStartupFunctions,
+                                       /*forStartupData=*/false, verbose,
                                        sections, rootSymbolToSectionIdxs);
 }
@@ -471,8 +471,11 @@ void UnwindInfoSectionImpl::finalize() {
   // vector of indices to entries and sort & fold that instead.
   cuIndices.resize(cuEntries.size());
   std::iota(cuIndices.begin(), cuIndices.end(), 0);
-  llvm::sort(cuIndices, [&](size_t a, size_t b) {
-    return cuEntries[a].functionAddress < cuEntries[b].functionAddress;
+  // Break ties by index so that the result does not depend on the sort
+  // algorithm.
+  parallelSort(cuIndices, [&](size_t a, size_t b) {
+    return std::tie(cuEntries[a].functionAddress, a) <
+           std::tie(cuEntries[b].functionAddress, b);
   });
 
   // Record the ending boundary before we fold the entries.
@@ -690,9 +693,11 @@ void UnwindInfoSectionImpl::writeTo(uint8_t *buf) const {
     lep++;
   }
 
-  // Level-2 pages
-  auto *pp = reinterpret_cast<uint32_t *>(lep);
-  for (const SecondLevelPage &page : secondLevelPages) {
+  // Level-2 pages. Each page has a fixed size, so write them in parallel.
+  auto *pagesBegin = reinterpret_cast<uint32_t *>(lep);
+  parallelFor(0, secondLevelPages.size(), [&](size_t pageIdx) {
+    const SecondLevelPage &page = secondLevelPages[pageIdx];
+    uint32_t *pp = pagesBegin + pageIdx * SECOND_LEVEL_PAGE_WORDS;
     if (page.kind == UNWIND_SECOND_LEVEL_COMPRESSED) {
       uintptr_t functionAddressBase =
           cuEntries[cuIndices[page.entryIndex]].functionAddress;
@@ -734,8 +739,7 @@ void UnwindInfoSectionImpl::writeTo(uint8_t *buf) const {
         *ep++ = cue.encoding;
       }
     }
-    pp += SECOND_LEVEL_PAGE_WORDS;
-  }
+  });
 }
 
 UnwindInfoSection *macho::makeUnwindInfoSection() {
@@ -1204,9 +1204,15 @@ void Writer::writeSections() {
   for (const OutputSegment *seg : outputSegments)
     append_range(osecs, seg->getSections());
 
+  // The unwind info section writes its second-level pages in parallel itself.
+  // Write it from this thread, because nested parallelism in a worker thread
+  // runs serially.
   parallelForEach(osecs.begin(), osecs.end(), [&](const OutputSection *osec) {
-    osec->writeTo(buf + osec->fileOff);
+    if (osec != in.unwindInfo)
+      osec->writeTo(buf + osec->fileOff);
   });
+  if (is_contained(osecs, in.unwindInfo))
+    in.unwindInfo->writeTo(buf + in.unwindInfo->fileOff);
 }
 
 void Writer::applyOptimizationHints() {
@@ -0,0 +1,199 @@
+//===- BPSectionOrdererTest.cpp -------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+// Links a small object with --bp-startup-sort and checks where the data
+// sections referenced by startup functions are placed.
+//===----------------------------------------------------------------------===//
+
+#ifndef LLD_DEFAULT_LD_LLD_IS_MINGW
+
+#include "lld/Common/Driver.h"
+#include "llvm/Object/ObjectFile.h"
+#include "llvm/ObjectYAML/yaml2obj.h"
+#include "llvm/ProfileData/InstrProfWriter.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FileUtilities.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/YAMLTraits.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+LLD_HAS_DRIVER(elf)
+
+namespace {
+
+// f1 loads from `hot`, which is placed after `cold` in the input.
+const char *inputYAML = R"(
+--- !ELF
+FileHeader:
+  Class:   ELFCLASS64
+  Data:    ELFDATA2LSB
+  Type:    ET_REL
+  Machine: EM_X86_64
+Sections:
+  - Name:         .text.f1
+    Type:         SHT_PROGBITS
+    Flags:        [ SHF_ALLOC, SHF_EXECINSTR ]
+    AddressAlign: 16
+    Content:      8B0500000000C3
+  - Name:         .text.f2
+    Type:         SHT_PROGBITS
+    Flags:        [ SHF_ALLOC, SHF_EXECINSTR ]
+    AddressAlign: 16
+    Content:      C3
+  - Name:         .rodata.cold
+    Type:         SHT_PROGBITS
+    Flags:        [ SHF_ALLOC ]
+    AddressAlign: 8
+    Content:      '0100000002000000'
+  - Name:         .rodata.hot
+    Type:         SHT_PROGBITS
+    Flags:        [ SHF_ALLOC ]
+    AddressAlign: 8
+    Content:      '0300000004000000'
+  - Name:         .rela.text.f1
+    Type:         SHT_RELA
+    Info:         .text.f1
+    Relocations:
+      - Offset: 2
+        Symbol: hot
+        Type:   R_X86_64_PC32
+        Addend: -4
+Symbols:
+  - Name:    f1
+    Type:    STT_FUNC
+    Section: .text.f1
+    Binding: STB_GLOBAL
+    Size:    7
+  - Name:    f2
+    Type:    STT_FUNC
+    Section: .text.f2
+    Binding: STB_GLOBAL
+    Size:    1
+  - Name:    cold
+    Type:    STT_OBJECT
+    Section: .rodata.cold
+    Binding: STB_GLOBAL
+    Size:    8
+  - Name:    hot
+    Type:    STT_OBJECT
+    Section: .rodata.hot
+    Binding: STB_GLOBAL
+    Size:    8
+)";
+
+class BPSectionOrdererTest : public testing::Test {
+protected:
+  void SetUp() override {
+    ASSERT_FALSE(sys::fs::createUniqueDirectory("lld-bp-test", dir));
+
+    // Object file.
+    objPath = path("in.o");
+    std::error_code ec;
+    raw_fd_ostream objOS(objPath, ec);
+    ASSERT_FALSE(ec);
+    yaml::Input yin(inputYAML);
+    ASSERT_TRUE(yaml::convertYAML(yin, objOS, [](const Twine &msg) {
+      ADD_FAILURE() << msg.str();
+    }));
+    objOS.close();
+
+    // Temporal profile in which only f1 runs at startup.
+    InstrProfWriter writer(/*Sparse=*/false, /*ReservoirSize=*/10,
+                           /*MaxTraceLength=*/10);
+    if (Error e = writer.mergeProfileKind(InstrProfKind::TemporalProfile))
+      FAIL() << toString(std::move(e));
+    auto warn = [](Error e) { ADD_FAILURE() << toString(std::move(e)); };
+    writer.addRecord({"f1", 0x1234, {1}}, warn);
+    writer.addRecord({"f2", 0x1234, {0}}, warn);
+    TemporalProfTraceTy trace;
+    trace.FunctionNameRefs = {IndexedInstrProf::ComputeHash("f1")};
+    SmallVector<TemporalProfTraceTy, 1> traces = {trace};
+    writer.addTemporalProfileTraces(traces, 1);
+
+    profilePath = path("startup.profdata");
+    raw_fd_ostream profOS(profilePath, ec);
+    ASSERT_FALSE(ec);
+    if (Error e = writer.write(profOS))
+      FAIL() << toString(std::move(e));
+    profOS.close();
+
+    outPath = path("out");
+  }
+
+  void TearDown() override { sys::fs::remove_directories(dir); }
+
+  std::string path(StringRef name) {
+    SmallString<128> p(dir);
+    sys::path::append(p, name);
+    return std::string(p);
+  }
+
+  // Links the input with the given --bp-startup-sort= value. Returns whether
+  // the link succeeded; diagnostics go to errors.
+  bool link(StringRef startupSort) {
+    std::string sortArg = ("--bp-startup-sort=" + startupSort).str();
+    std::string profileArg = "--irpgo-profile=" + profilePath;
+    std::vector<const char *> args{"ld.lld",           objPath.c_str(),
+                                   "-e",               "f1",
+                                   "-o",               outPath.c_str(),
+                                   sortArg.c_str(),    profileArg.c_str()};
+    errors.clear();
+    raw_string_ostream errOS(errors);
+    lld::Result r = lld::lldMain(args, outs(), errOS,
+                                 {{lld::Gnu, &lld::elf::link}});
+    return !r.retCode;
+  }
+
+  // Returns the address of each of the given symbols in the output.
+  std::vector<uint64_t> getAddresses(ArrayRef<StringRef> names) {
+    std::vector<uint64_t> addresses(names.size(), 0);
+    auto obj = object::ObjectFile::createObjectFile(outPath);
+    if (!obj) {
+      ADD_FAILURE() << toString(obj.takeError());
+      return addresses;
+    }
+    for (const object::SymbolRef &sym : obj->getBinary()->symbols()) {
+      StringRef name = cantFail(sym.getName());
+      for (auto [i, n] : enumerate(names))
+        if (name == n)
+          addresses[i] = cantFail(sym.getAddress());
+    }
+    return addresses;
+  }
+
+  SmallString<128> dir;
+  std::string objPath, profilePath, outPath;
+  std::string errors;
+};
+
+TEST_F(BPSectionOrdererTest, StartupFunctionsOnly) {
+  ASSERT_TRUE(link("function")) << errors;
+  auto addr = getAddresses({"cold", "hot"});
+  // Data keeps its input order.
+  EXPECT_LT(addr[0], addr[1]);
+}
+
+TEST_F(BPSectionOrdererTest, StartupData) {
+  ASSERT_TRUE(link("both")) << errors;
+  auto addr = getAddresses({"cold", "hot"});
+  // Data referenced by the startup function f1 is ordered first.
+  EXPECT_LT(addr[1], addr[0]);
+}
+
+TEST_F(BPSectionOrdererTest, InvalidStartupSort) {
+  EXPECT_FALSE(link("data"));
+  EXPECT_NE(errors.find("--bp-startup-sort=: expected [none|function|both]"),
+            std::string::npos)
+      << errors;
+}
+
+} // namespace
+
+#endif
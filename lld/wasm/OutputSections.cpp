@@ -16,6 +16,7 @@
 #include "lld/Common/Memory.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/Support/LEB128.h"
+#include "llvm/Support/Parallel.h"
 
 #define DEBUG_TYPE "lld"
 
@@ -76,9 +77,11 @@ void CodeSection::writeTo(uint8_t *buf) {
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
+  // Write code section bodies. Each function is written and relocated at its
+  // own outSecOff, so they can be written in parallel.
+  parallelForEach(functions, [buf](const InputChunk *chunk) {
     chunk->writeTo(buf);
+  });
 }
 
 uint32_t CodeSection::getNumRelocations() const {
@@ -172,17 +175,20 @@ void DataSection::writeTo(uint8_t *buf) {
   // Write data section headers
   memcpy(buf, dataSectionHeader.data(), dataSectionHeader.size());
 
+  SmallVector<const InputChunk *, 0> chunks;
   for (const OutputSegment *segment : segments) {
     if (!segment->requiredInBinary())
       continue;
     // Write data segment header
     uint8_t *segStart = buf + segment->sectionOffset;
     memcpy(segStart, segment->header.data(), segment->header.size());
-
-    // Write segment data payload
-    for (const InputChunk *chunk : segment->inputSegments)
-      chunk->writeTo(buf);
+    llvm::append_range(chunks, segment->inputSegments);
   }
+
+  // Write segment data payloads
+  parallelForEach(chunks, [buf](const InputChunk *chunk) {
+    chunk->writeTo(buf);
+  });
 }
 
 uint32_t DataSection::getNumRelocations() const {
@@ -219,10 +219,20 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+  // The code and data sections write their chunks in parallel themselves.
+  // Write them from this thread, because nested parallelism in a worker thread
+  // runs serially.
+  auto isParallel = [](OutputSection *s) {
+    return isa<CodeSection>(s) || isa<DataSection>(s);
+  };
+  parallelForEach(outputSections, [&](OutputSection *s) {
     assert(s->isNeeded());
-    s->writeTo(buf);
+    if (!isParallel(s))
+      s->writeTo(buf);
   });
+  for (OutputSection *s : outputSections)
+    if (isParallel(s))
+      s->writeTo(buf);
 }
 
 // Computes a hash value of Data using a given hash function.
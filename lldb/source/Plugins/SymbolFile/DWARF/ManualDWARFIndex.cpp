@@ -135,6 +135,13 @@ void ManualDWARFIndex::Index() {
   for (NameToDIE IndexSet<NameToDIE>::*index : indices) {
     task_group.async([this, &sets, index, &progress]() {
       NameToDIE &result = m_set.*index;
+      // Size the result up front: growing it while appending would
+      // repeatedly reallocate, and briefly double, a vector that can hold
+      // tens of millions of entries for large binaries.
+      size_t total_size = result.GetSize();
+      for (auto &set : sets)
+        total_size += (set.*index).GetSize();
+      result.Reserve(total_size);
       for (auto &set : sets)
         result.Append(set.*index);
       result.Finalize();
@@ -83,6 +83,11 @@ public:
 
   bool IsEmpty() const { return m_map.IsEmpty(); }
 
+  size_t GetSize() const { return m_map.GetSize(); }
+
+  /// Reserve memory for at least \a n entries.
+  void Reserve(size_t n) { m_map.Reserve(n); }
+
   void Clear() { m_map.Clear(); }
 
 protected:
@@ -104,6 +104,22 @@ setupStatsFile(StringRef StatsFilename);
 /// ordered indices to elements in the input array.
 LLVM_ABI std::vector<int> generateModulesOrdering(ArrayRef<BitcodeModule *> R);
 
+/// Same as above, but orders by the given per-module cost estimates (most
+/// expensive first), falling back to the bitcode size to break ties. Modules
+/// with a cost of 0 (no estimate) are ranked by their bitcode size, scaled by
+/// the size-to-cost ratio of the other modules.
+LLVM_ABI std::vector<int> generateModulesOrdering(ArrayRef<BitcodeModule *> R,
+                                                  ArrayRef<uint64_t> Costs);
+
+/// Returns a rough estimate of the work the ThinLTO backend will do for one
+/// module, derived from the combined summary: the instruction count of the
+/// functions it defines plus that of the function definitions it imports.
+/// Distributed build systems can use this to balance backend jobs.
+LLVM_ABI uint64_t
+estimateThinLTOBackendCost(const ModuleSummaryIndex &Index,
+                           const GVSummaryMapTy &DefinedGlobals,
+                           const FunctionImporter::ImportMapTy &ImportList);
+
 /// Updates MemProf attributes (and metadata) based on whether the index
 /// has recorded that we are linking with allocation libraries containing
 /// the necessary APIs for downstream transformations.
@@ -14,6 +14,7 @@
 #include "llvm/Analysis/LazyValueInfo.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/AssumptionCache.h"
 #include "llvm/Analysis/ConstantFolding.h"
 #include "llvm/Analysis/InstructionSimplify.h"
@@ -36,6 +37,7 @@
 #include "llvm/IR/PatternMatch.h"
 #include "llvm/IR/ValueHandle.h"
 #include "llvm/InitializePasses.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/FormattedStream.h"
 #include "llvm/Support/KnownBits.h"
@@ -46,9 +48,15 @@ using namespace PatternMatch;
 
 #define DEBUG_TYPE "lazy-value-info"
 
+STATISTIC(NumSolverAborts,
+          "Number of queries given up on due to the worklist item limit");
+
 // This is the number of worklist items we will process to try to discover an
 // answer for a given value.
-static const unsigned MaxProcessedPerValue = 500;
+static cl::opt<unsigned> MaxProcessedPerValue(
+    "lvi-max-processed-per-value", cl::Hidden, cl::init(500),
+    cl::desc("Maximum number of worklist items LVI processes to compute the "
+             "value of a single query before giving up"));
 
 char LazyValueInfoWrapperPass::ID = 0;
 LazyValueInfoWrapperPass::LazyValueInfoWrapperPass() : FunctionPass(ID) {}
@@ -476,6 +484,7 @@ void LazyValueInfoImpl::solve() {
     // PredicateInfo is used in LVI or CVP, we should be able to make the
     // overdefined cache global, and remove this throttle.
     if (processedCount > MaxProcessedPerValue) {
+      ++NumSolverAborts;
       LLVM_DEBUG(
           dbgs() << "Giving up on stack because we are getting too deep\n");
       // Fill in the original values
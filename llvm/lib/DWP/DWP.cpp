@@ -18,7 +18,10 @@
 #include "llvm/MC/MCTargetOptionsCommandFlags.h"
 #include "llvm/Object/Decompressor.h"
 #include "llvm/Object/ELFObjectFile.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include <limits>
+#include <optional>
 
 using namespace llvm;
 using namespace llvm::object;
@@ -659,8 +662,23 @@ Error write(MCStreamer &Out, ArrayRef<std::string> Inputs,
 
   std::deque<SmallString<32>> UncompressedSections;
 
-  for (const auto &Input : Inputs) {
-    auto ErrOrObj = object::ObjectFile::createObjectFile(Input);
+  // Packages are commonly built from many thousands of small .dwo files, for
+  // which opening and reading each file dominates. Load them in parallel up
+  // front; their contents are still processed in input order below.
+  std::vector<std::optional<ErrorOr<std::unique_ptr<MemoryBuffer>>>> Buffers(
+      Inputs.size());
+  parallelFor(0, Inputs.size(), [&](size_t I) {
+    Buffers[I].emplace(MemoryBuffer::getFile(Inputs[I], /*IsText=*/false,
+                                             /*RequiresNullTerminator=*/false));
+  });
+
+  for (auto [Input, BufferOrErr] : zip_equal(Inputs, Buffers)) {
+    if (std::error_code EC = BufferOrErr->getError())
+      return createFileError(Input, errorCodeToError(EC));
+    std::unique_ptr<MemoryBuffer> Buffer = std::move(**BufferOrErr);
+
+    auto ErrOrObj =
+        object::ObjectFile::createObjectFile(Buffer->getMemBufferRef());
     if (!ErrOrObj) {
       return handleErrors(ErrOrObj.takeError(),
                           [&](std::unique_ptr<ECError> EC) -> Error {
@@ -668,8 +686,8 @@ Error write(MCStreamer &Out, ArrayRef<std::string> Inputs,
                           });
     }
 
-    auto &Obj = *ErrOrObj->getBinary();
-    Objects.push_back(std::move(*ErrOrObj));
+    auto &Obj = **ErrOrObj;
+    Objects.emplace_back(std::move(*ErrOrObj), std::move(Buffer));
 
     UnitIndexEntry CurEntry = {};
 
@@ -2075,15 +2075,23 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
         if (Error E = ProcessOneModule(I))
           return E;
     } else {
-      // When executing in parallel, process largest bitsize modules first to
-      // improve parallelism, and avoid starving the thread pool near the end.
-      // This saves about 15 sec on a 36-core machine while link `clang.exe`
-      // (out of 100 sec).
+      // When executing in parallel, process the most expensive modules first
+      // to improve parallelism, and avoid starving the thread pool near the
+      // end. This saves about 15 sec on a 36-core machine while link
+      // `clang.exe` (out of 100 sec). The cost is estimated from the summary,
+      // which also accounts for the functions each module imports.
       std::vector<BitcodeModule *> ModulesVec;
+      std::vector<uint64_t> Costs;
       ModulesVec.reserve(ModuleMap.size());
-      for (auto &Mod : ModuleMap)
+      Costs.reserve(ModuleMap.size());
+      for (auto &Mod : ModuleMap) {
         ModulesVec.push_back(&Mod.second);
-      for (int I : generateModulesOrdering(ModulesVec))
+        Costs.push_back(estimateThinLTOBackendCost(
+            ThinLTO.CombinedIndex,
+            ModuleToDefinedGVSummaries.find(Mod.first)->second,
+            ImportLists[Mod.first]));
+      }
+      for (int I : generateModulesOrdering(ModulesVec, Costs))
         if (Error E = ProcessOneModule(I))
           return E;
     }
@@ -2191,6 +2199,52 @@ std::vector<int> lto::generateModulesOrdering(ArrayRef<BitcodeModule *> R) {
   return ModulesOrdering;
 }
 
+std::vector<int> lto::generateModulesOrdering(ArrayRef<BitcodeModule *> R,
+                                              ArrayRef<uint64_t> Costs) {
+  assert(R.size() == Costs.size() && "expected one cost per module");
+  // Modules without function summaries have no cost estimate. Convert their
+  // bitcode size to the same scale, using the size-to-cost ratio of the
+  // modules that do have an estimate, so they are not all scheduled last.
+  double TotalCost = 0, TotalSize = 0;
+  for (auto [M, Cost] : zip_equal(R, Costs))
+    if (Cost) {
+      TotalCost += Cost;
+      TotalSize += M->getBuffer().size();
+    }
+  double CostPerByte = TotalSize ? TotalCost / TotalSize : 1.0;
+  std::vector<double> EffectiveCosts;
+  EffectiveCosts.reserve(R.size());
+  for (auto [M, Cost] : zip_equal(R, Costs))
+    EffectiveCosts.push_back(Cost ? Cost : M->getBuffer().size() * CostPerByte);
+
+  auto Seq = llvm::seq<int>(0, R.size());
+  std::vector<int> ModulesOrdering(Seq.begin(), Seq.end());
+  llvm::stable_sort(ModulesOrdering, [&](int LeftIndex, int RightIndex) {
+    if (EffectiveCosts[LeftIndex] != EffectiveCosts[RightIndex])
+      return EffectiveCosts[LeftIndex] > EffectiveCosts[RightIndex];
+    return R[LeftIndex]->getBuffer().size() > R[RightIndex]->getBuffer().size();
+  });
+  return ModulesOrdering;
+}
+
+uint64_t
+lto::estimateThinLTOBackendCost(const ModuleSummaryIndex &Index,
+                                const GVSummaryMapTy &DefinedGlobals,
+                                const FunctionImporter::ImportMapTy &ImportList) {
+  auto InstCount = [](const GlobalValueSummary *S) -> uint64_t {
+    if (auto *FS = dyn_cast_or_null<FunctionSummary>(S))
+      return FS->instCount();
+    return 0;
+  };
+  uint64_t Cost = 0;
+  for (const auto &[GUID, S] : DefinedGlobals)
+    Cost += InstCount(S);
+  for (const auto &[FromModule, GUID, Type] : ImportList)
+    if (Type == GlobalValueSummary::Definition)
+      Cost += InstCount(Index.findSummaryInModule(GUID, FromModule));
+  return Cost;
+}
+
 namespace {
 /// This out-of-process backend does not perform code generation when invoked
 /// for each task. Instead, it generates the necessary information (e.g., the
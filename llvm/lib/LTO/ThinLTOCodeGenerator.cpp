@@ -1103,11 +1103,21 @@ void ThinLTOCodeGenerator::run() {
     ModuleToDefinedGVSummaries[ModuleIdentifier];
   }
 
+  // Schedule the most expensive modules first, estimating the cost from the
+  // summary so that the functions each module imports are accounted for.
   std::vector<BitcodeModule *> ModulesVec;
+  std::vector<uint64_t> Costs;
   ModulesVec.reserve(Modules.size());
-  for (auto &Mod : Modules)
+  Costs.reserve(Modules.size());
+  for (auto &Mod : Modules) {
+    auto ModuleIdentifier = Mod->getName();
     ModulesVec.push_back(&Mod->getSingleBitcodeModule());
-  std::vector<int> ModulesOrdering = lto::generateModulesOrdering(ModulesVec);
+    Costs.push_back(lto::estimateThinLTOBackendCost(
+        *Index, ModuleToDefinedGVSummaries[ModuleIdentifier],
+        ImportLists[ModuleIdentifier]));
+  }
+  std::vector<int> ModulesOrdering =
+      lto::generateModulesOrdering(ModulesVec, Costs);
 
   if (llvm::timeTraceProfilerEnabled())
     llvm::timeTraceProfilerEnd();
@@ -56,6 +56,11 @@ static cl::opt<bool> VerifyAnalysisInvalidation("verify-analysis-invalidation",
 #endif
 );
 
+static cl::opt<bool> VerifyEachIncremental(
+    "verify-each-incremental", cl::Hidden, cl::init(false),
+    cl::desc("With -verify-each, skip verification after passes that "
+             "preserve all analyses"));
+
 // An option that supports the -print-changed option.  See
 // the description for -print-changed for an explanation of the use
 // of this option.  Note that this option has no effect without -print-changed.
@@ -1458,6 +1463,15 @@ void VerifyInstrumentation::registerCallbacks(PassInstrumentationCallbacks &PIC,
       [this, MAM](StringRef P, Any IR, const PreservedAnalyses &PassPA) {
         if (isIgnored(P) || P == "VerifierPass")
           return;
+        // With -verify-each-incremental, trust that a pass that preserves all
+        // analyses has not changed the IR, which was already verified after
+        // the previous pass. This also skips passes that wrongly claim so.
+        if (VerifyEachIncremental && PassPA.areAllPreserved()) {
+          if (DebugLogging)
+            dbgs() << "Skipping verification after pass " << P
+                   << " (all analyses preserved)\n";
+          return;
+        }
         const auto *F = unwrapIR<Function>(IR);
         if (!F) {
           if (const auto *L = unwrapIR<Loop>(IR))
@@ -393,6 +393,10 @@ void InstrProfWriter::mergeRecordsFromWriter(InstrProfWriter &&IPW,
   for (auto &I : IPW.FunctionData)
     for (auto &Func : I.getValue())
       addRecord(I.getKey(), Func.first, std::move(Func.second), 1, Warn);
+  // The records have been moved out; release the source's map right away so
+  // that a tree of merges (llvm-profdata merge -j) does not keep every
+  // intermediate writer's function table alive.
+  IPW.FunctionData.clear();
 
   BinaryIds.reserve(BinaryIds.size() + IPW.BinaryIds.size());
   for (auto &I : IPW.BinaryIds)
@@ -15,7 +15,9 @@
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/PassManagerImpl.h"
+#include "llvm/IR/Verifier.h"
 #include "llvm/Passes/StandardInstrumentations.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Transforms/Scalar/SimplifyCFG.h"
 #include "gtest/gtest.h"
@@ -960,6 +962,90 @@ TEST_F(PassManagerTest, FunctionPassCFGCheckerWrapped) {
   FPM.run(*F, FAM);
 }
 
+// FunctionPass that breaks dominance in @foo by moving %b before its operand
+// %a, and reports either that it preserved everything or nothing.
+struct BreakDominancePass : PassInfoMixin<BreakDominancePass> {
+  BreakDominancePass(bool PreserveAll) : PreserveAll(PreserveAll) {}
+  PreservedAnalyses run(Function &F, FunctionAnalysisManager &FAM) {
+    Instruction &A = *F.getEntryBlock().begin();
+    A.getNextNode()->moveBefore(A.getIterator());
+    return PreserveAll ? PreservedAnalyses::all() : PreservedAnalyses::none();
+  }
+  static StringRef name() { return "BreakDominancePass"; }
+
+  bool PreserveAll;
+};
+
+static void setVerifyEachIncremental(bool Value) {
+  auto &Opts = cl::getRegisteredOptions();
+  static_cast<cl::opt<bool> *>(Opts["verify-each-incremental"])
+      ->setValue(Value);
+}
+
+static void runVerifyEach(Module &M, bool PreserveAll) {
+  FunctionAnalysisManager FAM;
+  ModuleAnalysisManager MAM;
+  FunctionPassManager FPM;
+  PassInstrumentationCallbacks PIC;
+  StandardInstrumentations SI(M.getContext(), /*DebugLogging*/ true,
+                              /*VerifyEach*/ true);
+  SI.registerCallbacks(PIC, &MAM);
+  MAM.registerPass([&] { return PassInstrumentationAnalysis(&PIC); });
+  MAM.registerPass([&] { return FunctionAnalysisManagerModuleProxy(FAM); });
+  FAM.registerPass([&] { return PassInstrumentationAnalysis(&PIC); });
+
+  FPM.addPass(BreakDominancePass(PreserveAll));
+  FPM.run(*M.getFunction("foo"), FAM);
+}
+
+static const char *VerifyEachIR = "define i32 @foo() {\n"
+                                  "  %a = add i32 1, 2\n"
+                                  "  %b = add i32 %a, 1\n"
+                                  "  ret i32 %b\n"
+                                  "}\n";
+
+#ifdef GTEST_HAS_DEATH_TEST
+// -verify-each still verifies after a pass that changes the IR, with or
+// without -verify-each-incremental.
+TEST_F(PassManagerTest, VerifyEachAfterChangingPass) {
+  LLVMContext Context;
+  auto M = parseIR(Context, VerifyEachIR);
+  EXPECT_DEATH(runVerifyEach(*M, /*PreserveAll*/ false),
+               "Broken function found after pass \"BreakDominancePass\"");
+
+  setVerifyEachIncremental(true);
+  EXPECT_DEATH(runVerifyEach(*M, /*PreserveAll*/ false),
+               "Broken function found after pass \"BreakDominancePass\"");
+  setVerifyEachIncremental(false);
+}
+#endif
+
+// The tests below run a pass that changes the IR but claims to preserve all
+// analyses. With EXPENSIVE_CHECKS the function hash check reports that pass
+// before the verifier runs.
+#ifndef EXPENSIVE_CHECKS
+#ifdef GTEST_HAS_DEATH_TEST
+// Without -verify-each-incremental, such a pass is still verified.
+TEST_F(PassManagerTest, VerifyEachAfterPreservingPass) {
+  LLVMContext Context;
+  auto M = parseIR(Context, VerifyEachIR);
+  EXPECT_DEATH(runVerifyEach(*M, /*PreserveAll*/ true),
+               "Broken function found after pass \"BreakDominancePass\"");
+}
+#endif
+
+// With -verify-each-incremental, verification is skipped after a pass that
+// preserves all analyses, so the broken function is not reported.
+TEST_F(PassManagerTest, VerifyEachIncrementalSkipsPreservingPass) {
+  LLVMContext Context;
+  auto M = parseIR(Context, VerifyEachIR);
+  setVerifyEachIncremental(true);
+  runVerifyEach(*M, /*PreserveAll*/ true);
+  setVerifyEachIncremental(false);
+  EXPECT_TRUE(verifyFunction(*M->getFunction("foo")));
+}
+#endif
+
 #ifdef EXPENSIVE_CHECKS
 
 struct WrongFunctionPass : PassInfoMixin<WrongFunctionPass> {
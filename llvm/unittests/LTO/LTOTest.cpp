@@ -0,0 +1,145 @@
+//===- LTOTest.cpp - LTO unit tests ---------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/LTO/LTO.h"
+#include "llvm/AsmParser/Parser.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ModuleSummaryIndex.h"
+#include "llvm/Support/SourceMgr.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+static std::unique_ptr<ModuleSummaryIndex> makeLLVMIndex(const char *Summary) {
+  SMDiagnostic Err;
+  std::unique_ptr<ModuleSummaryIndex> Index =
+      parseSummaryIndexAssemblyString(Summary, Err);
+  if (!Index)
+    Err.print("LTOTest", errs());
+  return Index;
+}
+
+TEST(LTOTest, EstimateThinLTOBackendCost) {
+  std::unique_ptr<ModuleSummaryIndex> Index = makeLLVMIndex(R"Summary(
+^0 = module: (path: "a.o", hash: (0, 0, 0, 0, 0))
+^1 = module: (path: "b.o", hash: (0, 0, 0, 0, 0))
+^2 = module: (path: "c.o", hash: (0, 0, 0, 0, 0))
+^3 = gv: (guid: 1, summaries: (function: (module: ^0, flags: (linkage: external), insts: 10)))
+^4 = gv: (guid: 2, summaries: (function: (module: ^0, flags: (linkage: external), insts: 3)))
+^5 = gv: (guid: 3, summaries: (function: (module: ^1, flags: (linkage: external), insts: 7)))
+^6 = gv: (guid: 4, summaries: (function: (module: ^1, flags: (linkage: external), insts: 5)))
+^7 = gv: (guid: 5, summaries: (variable: (module: ^2, flags: (linkage: external), varFlags: (readonly: 0, writeonly: 0, constant: 0))))
+)Summary");
+  ASSERT_NE(Index, nullptr);
+
+  DenseMap<StringRef, GVSummaryMapTy> ModuleToDefinedGVSummaries;
+  Index->collectDefinedGVSummariesPerModule(ModuleToDefinedGVSummaries);
+
+  // a.o imports the definition of guid 3 from b.o, and only a declaration of
+  // guid 4, which does not add to its cost.
+  FunctionImporter::ImportListsTy ImportLists;
+  ImportLists["a.o"].addDefinition("b.o", 3);
+  ImportLists["a.o"].maybeAddDeclaration("b.o", 4);
+
+  EXPECT_EQ(lto::estimateThinLTOBackendCost(
+                *Index, ModuleToDefinedGVSummaries["a.o"], ImportLists["a.o"]),
+            10u + 3u + 7u);
+  EXPECT_EQ(lto::estimateThinLTOBackendCost(
+                *Index, ModuleToDefinedGVSummaries["b.o"], ImportLists["b.o"]),
+            7u + 5u);
+  // Variables do not contribute to the cost.
+  EXPECT_EQ(lto::estimateThinLTOBackendCost(
+                *Index, ModuleToDefinedGVSummaries["c.o"], ImportLists["c.o"]),
+            0u);
+}
+
+class GenerateModulesOrderingTest : public testing::Test {
+protected:
+  // Adds a bitcode module with NumFunctions trivial functions, so that its
+  // bitcode size grows with NumFunctions.
+  void addModule(unsigned NumFunctions) {
+    std::string IR;
+    for (unsigned I = 0; I != NumFunctions; ++I)
+      IR += "define void @f" + std::to_string(I) + "() {\n  ret void\n}\n";
+    SMDiagnostic Err;
+    std::unique_ptr<Module> M = parseAssemblyString(IR, Err, Context);
+    ASSERT_TRUE(M);
+
+    Buffers.push_back(std::make_unique<SmallVector<char, 0>>());
+    raw_svector_ostream OS(*Buffers.back());
+    WriteBitcodeToFile(*M, OS);
+
+    MemoryBufferRef Ref(
+        StringRef(Buffers.back()->data(), Buffers.back()->size()), "m");
+    std::vector<BitcodeModule> BMs = cantFail(getBitcodeModuleList(Ref));
+    ASSERT_EQ(BMs.size(), 1u);
+    Modules.push_back(std::make_unique<BitcodeModule>(BMs.front()));
+  }
+
+  std::vector<BitcodeModule *> getModules() {
+    std::vector<BitcodeModule *> Result;
+    for (auto &M : Modules)
+      Result.push_back(M.get());
+    return Result;
+  }
+
+  size_t getSize(unsigned I) { return Modules[I]->getBuffer().size(); }
+
+  LLVMContext Context;
+  std::vector<std::unique_ptr<SmallVector<char, 0>>> Buffers;
+  std::vector<std::unique_ptr<BitcodeModule>> Modules;
+};
+
+TEST_F(GenerateModulesOrderingTest, BySize) {
+  addModule(1);
+  addModule(20);
+  addModule(5);
+  ASSERT_GT(getSize(1), getSize(2));
+  ASSERT_GT(getSize(2), getSize(0));
+
+  EXPECT_EQ(lto::generateModulesOrdering(getModules()),
+            (std::vector<int>{1, 2, 0}));
+}
+
+TEST_F(GenerateModulesOrderingTest, ByCost) {
+  addModule(1);
+  addModule(20);
+  addModule(5);
+
+  // The cost estimate takes precedence over the bitcode size.
+  EXPECT_EQ(lto::generateModulesOrdering(getModules(), {30, 10, 20}),
+            (std::vector<int>{0, 2, 1}));
+  // Equal costs are ordered by bitcode size.
+  EXPECT_EQ(lto::generateModulesOrdering(getModules(), {10, 10, 10}),
+            (std::vector<int>{1, 2, 0}));
+}
+
+TEST_F(GenerateModulesOrderingTest, ZeroCostFallsBackToSize) {
+  addModule(1);
+  addModule(200);
+  addModule(1);
+  // Scaled by the ratio (10 + 5) / (size 0 + size 2), module 1 must exceed the
+  // cost of module 0.
+  ASSERT_GT(getSize(1) * 15, 10 * (getSize(0) + getSize(2)));
+
+  // Module 1 has no cost estimate. Scaled by the cost per byte of the other
+  // modules, its much larger bitcode makes it the most expensive one, rather
+  // than the cheapest.
+  EXPECT_EQ(lto::generateModulesOrdering(getModules(), {10, 0, 5}),
+            (std::vector<int>{1, 0, 2}));
+  // Without any cost estimate, modules are ordered by bitcode size.
+  EXPECT_EQ(lto::generateModulesOrdering(getModules(), {0, 0, 0}),
+            (std::vector<int>{1, 0, 2}));
+}
+
+} // end anonymous namespace
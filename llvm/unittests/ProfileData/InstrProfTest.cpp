@@ -247,6 +247,7 @@ TEST_F(InstrProfTest, test_writer_merge) {
   Writer2.addRecord({"func2", 0x1234, {0, 0}}, Err);
 
   Writer.mergeRecordsFromWriter(std::move(Writer2), Err);
+  EXPECT_TRUE(Writer2.getProfileData().empty());
 
   auto Profile = Writer.writeBuffer();
   readProfile(std::move(Profile));